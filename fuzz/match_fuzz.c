@@ -0,0 +1,350 @@
+// Host fuzzer for src/match.c. Drives random point/undo sequences through
+// the engine, compares every state with the independent model in
+// reference.c, checks invariants and the point timeline, and shrinks any
+// failing sequence to a minimal reproducer.
+//
+//   match_fuzz [-n sequences] [-s seed]   Random run
+//   match_fuzz -r 12u21...                Replay one sequence (1, 2, u=undo)
+
+#include "../src/match.h"
+#include "reference.h"
+#include <stdlib.h>
+#include <time.h>
+
+#define MAX_OPS 1600
+#define RANDOM_SEEKS 16
+
+#define OP_P1 0
+#define OP_P2 1
+#define OP_UNDO 2
+
+static char s_failure[256];
+static long s_points_played = 0;
+static uint64_t s_rng;
+
+// Model of the whole match after each recorded point, for timeline checks
+static RefState s_history[MAX_OPS + 1];
+
+// Expected nearest game / set starts around every timeline position
+static int s_prev_game[MAX_OPS + 2];
+static int s_next_game[MAX_OPS + 2];
+static int s_prev_set[MAX_OPS + 2];
+static int s_next_set[MAX_OPS + 2];
+
+// --- Helpers ---
+
+static uint64_t next_random() {
+  // xorshift64*
+  s_rng ^= s_rng >> 12;
+  s_rng ^= s_rng << 25;
+  s_rng ^= s_rng >> 27;
+  return s_rng * 2685821657736338717ULL;
+}
+
+static int random_below(int limit) { return (int)(next_random() % limit); }
+
+static bool fail(int step, const char *what) {
+  snprintf(s_failure, sizeof(s_failure), "step %d: %s", step, what);
+  return false;
+}
+
+static bool is_valid_point_score(int score) {
+  return score == 0 || score == 15 || score == 30 || score == 40 ||
+         score == 50;
+}
+
+static bool matches_reference(const MatchState *state, const RefState *ref) {
+  return state->p1_score == ref_display_score(ref, 0) &&
+         state->p2_score == ref_display_score(ref, 1) &&
+         state->p1_games == ref->games[0] && state->p2_games == ref->games[1] &&
+         state->p1_sets == ref->sets[0] && state->p2_sets == ref->sets[1] &&
+         state->server == ref_server(ref) && !state->is_tiebreak;
+}
+
+// Checks that hold for any engine state, without looking at the model
+static const char *check_invariants(const MatchState *state) {
+  if (!is_valid_point_score(state->p1_score) ||
+      !is_valid_point_score(state->p2_score))
+    return "point score outside 0/15/30/40/Ad";
+  if ((state->p1_score == 50 && state->p2_score != 40) ||
+      (state->p2_score == 50 && state->p1_score != 40))
+    return "Ad without opponent on 40";
+  if (state->p1_games < 0 || state->p2_games < 0 || state->p1_games > 6 ||
+      state->p2_games > 6)
+    return "games outside 0-6 (a won set must reset games)";
+  if ((state->p1_games == 6 && state->p2_games < 5) ||
+      (state->p2_games == 6 && state->p1_games < 5))
+    return "set won but not closed";
+  if (state->p1_sets < 0 || state->p2_sets < 0)
+    return "negative sets";
+  if (state->server != 0 && state->server != 1)
+    return "server not 0 or 1";
+  return NULL;
+}
+
+// --- Timeline ---
+
+static bool is_game_start(const RefState *ref) {
+  return ref->points[0] == 0 && ref->points[1] == 0;
+}
+
+static bool is_set_start(const RefState *ref) {
+  return is_game_start(ref) && ref->games[0] == 0 && ref->games[1] == 0;
+}
+
+// Fills the expected boundaries from the model. Only recorded points can
+// be a boundary, past them the next boundary is the live end.
+static void build_boundaries(int recorded, int length) {
+  int game = 0;
+  int set = 0;
+  for (int t = 0; t <= length; t++) {
+    s_prev_game[t] = game;
+    s_prev_set[t] = set;
+    if (t <= recorded && is_game_start(&s_history[t]))
+      game = t;
+    if (t <= recorded && is_set_start(&s_history[t]))
+      set = t;
+  }
+
+  game = length;
+  set = length;
+  for (int t = length; t >= 0; t--) {
+    s_next_game[t] = game;
+    s_next_set[t] = set;
+    if (t <= recorded && is_game_start(&s_history[t]))
+      game = t;
+    if (t <= recorded && is_set_start(&s_history[t]))
+      set = t;
+  }
+}
+
+static bool check_boundaries(int from) {
+  if (match_timeline_game_boundary(from, -1) != s_prev_game[from])
+    return fail(-1, "previous game start is wrong");
+  if (match_timeline_game_boundary(from, 1) != s_next_game[from])
+    return fail(-1, "next game start is wrong");
+  if (match_timeline_set_boundary(from, -1) != s_prev_set[from])
+    return fail(-1, "previous set start is wrong");
+  if (match_timeline_set_boundary(from, 1) != s_next_set[from])
+    return fail(-1, "next set start is wrong");
+  return true;
+}
+
+static bool check_timeline(int point_count, const RefState *live) {
+  int recorded = point_count;
+  int expected_length = point_count;
+  if (point_count > MATCH_TIMELINE_CAPACITY) {
+    recorded = MATCH_TIMELINE_CAPACITY;
+    expected_length = MATCH_TIMELINE_CAPACITY + 1; // Last position is live
+  }
+  int length = match_timeline_length();
+  if (length != expected_length)
+    return fail(-1, "timeline length does not match points played");
+
+  // Forward scan reuses the cursor, random seeks jump both ways
+  MatchCursor cursor = {.point_index = -1};
+  for (int i = 0; i <= length + RANDOM_SEEKS; i++) {
+    int target = (i <= length) ? i : random_below(length + 1);
+    const RefState *want = (target == length) ? live : &s_history[target];
+
+    match_timeline_seek(&cursor, target);
+    if (cursor.point_index != target)
+      return fail(-1, "timeline seek landed on the wrong point");
+    if (!matches_reference(&cursor.state, want))
+      return fail(-1, "timeline state differs from reference");
+    if (match_timeline_replay_cost(target) > MATCH_TIMELINE_MAX_REPLAY)
+      return fail(-1, "seek replays more than the checkpoint gap");
+  }
+
+  // Boundary lookups scan checkpoints, so sample them (always both ends)
+  build_boundaries(recorded, length);
+  if (!check_boundaries(0) || !check_boundaries(length) ||
+      !check_boundaries(recorded))
+    return false;
+  for (int i = 0; i < RANDOM_SEEKS; i++) {
+    if (!check_boundaries(random_below(length + 1)))
+      return false;
+  }
+  return true;
+}
+
+// --- Sequence Runner ---
+
+// Runs ops from a fresh match, returns false and fills s_failure on the
+// first mismatch
+static bool run_sequence(const uint8_t *ops, int count) {
+  RefState ref;
+  RefState ref_prev;
+  bool can_undo = false;
+  int point_count = 0;
+
+  match_reset();
+  ref_reset(&ref);
+  s_history[0] = ref;
+
+  for (int i = 0; i < count; i++) {
+    MatchState before = *match_get_state();
+
+    if (ops[i] == OP_UNDO) {
+      match_undo();
+      if (can_undo) {
+        ref = ref_prev;
+        point_count--;
+        can_undo = false; // Engine keeps a single level
+      }
+    } else {
+      int games_before = ref.games_played;
+      ref_prev = ref;
+      match_add_point(ops[i]);
+      ref_add_point(&ref, ops[i]);
+      can_undo = true;
+      s_history[++point_count] = ref;
+      s_points_played++;
+
+      const MatchState *after = match_get_state();
+      if (after->p1_sets < before.p1_sets || after->p2_sets < before.p2_sets)
+        return fail(i, "sets decreased");
+      if ((after->server != before.server) !=
+          (ref.games_played != games_before))
+        return fail(i, "server did not alternate with the game");
+    }
+
+    const MatchState *state = match_get_state();
+    const char *broken = check_invariants(state);
+    if (broken)
+      return fail(i, broken);
+    if (!matches_reference(state, &ref))
+      return fail(i, "state differs from reference");
+    if (match_can_undo() != can_undo)
+      return fail(i, "undo availability differs from reference");
+  }
+
+  return check_timeline(point_count, &ref);
+}
+
+// --- Shrinking ---
+
+// Delta debugging: drop ever smaller chunks while the sequence still fails
+static int shrink(uint8_t *ops, int count) {
+  static uint8_t candidate[MAX_OPS];
+  int chunks = 2;
+
+  while (count >= 2) {
+    int size = (count + chunks - 1) / chunks;
+    bool reduced = false;
+
+    for (int start = 0; start < count; start += size) {
+      int end = (start + size < count) ? start + size : count;
+      int length = count - (end - start);
+      memcpy(candidate, ops, start);
+      memcpy(candidate + start, ops + end, count - end);
+
+      if (!run_sequence(candidate, length)) {
+        memcpy(ops, candidate, length);
+        count = length;
+        chunks = (chunks > 2) ? chunks - 1 : 2;
+        reduced = true;
+        break;
+      }
+    }
+
+    if (!reduced) {
+      if (chunks >= count)
+        break;
+      chunks = (chunks * 2 < count) ? chunks * 2 : count;
+    }
+  }
+
+  run_sequence(ops, count); // Leave s_failure describing the minimal case
+  return count;
+}
+
+static void print_ops(const uint8_t *ops, int count) {
+  for (int i = 0; i < count; i++) {
+    putchar(ops[i] == OP_UNDO ? 'u' : '1' + ops[i]);
+  }
+  putchar('\n');
+}
+
+static int parse_ops(const char *text, uint8_t *ops) {
+  int count = 0;
+  for (; *text && count < MAX_OPS; text++) {
+    if (*text == '1' || *text == '2') {
+      ops[count++] = *text - '1';
+    } else if (*text == 'u' || *text == 'U') {
+      ops[count++] = OP_UNDO;
+    }
+  }
+  return count;
+}
+
+// --- Main ---
+
+static int report_failure(uint8_t *ops, int count) {
+  printf("FAIL (%d ops): %s\n", count, s_failure);
+  count = shrink(ops, count);
+  printf("Minimal reproducer (%d ops): %s\n", count, s_failure);
+  print_ops(ops, count);
+  return 1;
+}
+
+int main(int argc, char **argv) {
+  static uint8_t ops[MAX_OPS];
+  long sequences = 100000;
+  uint64_t seed = (uint64_t)time(NULL);
+  const char *replay = NULL;
+
+  for (int i = 1; i + 1 < argc; i += 2) {
+    if (strcmp(argv[i], "-n") == 0) {
+      sequences = atol(argv[i + 1]);
+    } else if (strcmp(argv[i], "-s") == 0) {
+      seed = strtoull(argv[i + 1], NULL, 10);
+    } else if (strcmp(argv[i], "-r") == 0) {
+      replay = argv[i + 1];
+    }
+  }
+
+  if (replay) {
+    int count = parse_ops(replay, ops);
+    if (run_sequence(ops, count)) {
+      printf("PASS (%d ops)\n", count);
+      return 0;
+    }
+    return report_failure(ops, count);
+  }
+
+  printf("Seed %llu, %ld sequences\n", (unsigned long long)seed, sequences);
+  s_rng = seed ? seed : 1;
+  clock_t start = clock();
+
+  for (long n = 0; n < sequences; n++) {
+    // Mix of short sets, long matches past the timeline capacity, and
+    // lopsided or deuce-heavy point streams
+    int count = (random_below(8) == 0) ? random_below(MAX_OPS + 1)
+                                       : random_below(600);
+    int p1_bias = 25 + random_below(51);
+    int undo_rate = random_below(16);
+    bool deuce_heavy = random_below(8) == 0; // Games past the replay gap
+
+    for (int i = 0; i < count; i++) {
+      if (random_below(100) < undo_rate) {
+        ops[i] = OP_UNDO;
+      } else if (deuce_heavy && i > 0 && ops[i - 1] != OP_UNDO &&
+                 random_below(100) < 97) {
+        ops[i] = !ops[i - 1]; // Alternate winners to stay at deuce
+      } else {
+        ops[i] = (random_below(100) < p1_bias) ? OP_P1 : OP_P2;
+      }
+    }
+
+    if (!run_sequence(ops, count)) {
+      printf("Sequence %ld\n", n);
+      return report_failure(ops, count);
+    }
+  }
+
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+  printf("PASS: %ld points in %.2fs (%.1fM points/s)\n", s_points_played,
+         seconds, s_points_played / seconds / 1e6);
+  return 0;
+}
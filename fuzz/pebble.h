@@ -0,0 +1,34 @@
+#pragma once
+
+// Host stand-in for the Pebble SDK header, just enough for src/match.c and
+// src/gesture.c
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define APP_LOG(level, ...)
+
+typedef struct {
+  int16_t x;
+  int16_t y;
+  int16_t z;
+  bool did_vibrate;
+  uint64_t timestamp;
+} AccelData;
+
+typedef void (*AccelDataHandler)(AccelData *data, uint32_t num_samples);
+
+typedef enum {
+  ACCEL_SAMPLING_10HZ = 10,
+  ACCEL_SAMPLING_25HZ = 25,
+  ACCEL_SAMPLING_50HZ = 50,
+  ACCEL_SAMPLING_100HZ = 100,
+} AccelSamplingRate;
+
+// Provided by the test that links src/gesture.c
+void accel_data_service_subscribe(uint32_t samples_per_update,
+                                  AccelDataHandler handler);
+void accel_data_service_unsubscribe(void);
+int accel_service_set_sampling_rate(AccelSamplingRate rate);
@@ -0,0 +1,43 @@
+#include "reference.h"
+
+static const int s_display[] = {0, 15, 30, 40};
+
+void ref_reset(RefState *ref) {
+  ref->points[0] = ref->points[1] = 0;
+  ref->games[0] = ref->games[1] = 0;
+  ref->sets[0] = ref->sets[1] = 0;
+  ref->games_played = 0;
+}
+
+void ref_add_point(RefState *ref, int player) {
+  int other = !player;
+  ref->points[player]++;
+
+  // Game: first to 4 points, two clear
+  if (ref->points[player] < 4 || ref->points[player] - ref->points[other] < 2)
+    return;
+
+  ref->points[0] = ref->points[1] = 0;
+  ref->games[player]++;
+  ref->games_played++;
+
+  // Set: first to 6 games two clear, or 7-6 (tiebreak played as a game)
+  int won = ref->games[player];
+  int lost = ref->games[other];
+  if ((won >= 6 && won - lost >= 2) || (won == 7 && lost == 6)) {
+    ref->sets[player]++;
+    ref->games[0] = ref->games[1] = 0;
+  }
+}
+
+int ref_display_score(const RefState *ref, int player) {
+  int own = ref->points[player];
+  int other = ref->points[!player];
+
+  if (own >= 3 && other >= 3) {
+    return (own > other) ? 50 : 40; // Ad / Deuce
+  }
+  return s_display[own];
+}
+
+int ref_server(const RefState *ref) { return ref->games_played % 2; }
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdbool.h>
+
+// Independent scoring model for the fuzzer. Tracks raw points won instead
+// of 0/15/30/40/Ad and only maps to the tennis display at comparison time.
+typedef struct {
+  int points[2]; // Points won in the current game
+  int games[2];
+  int sets[2];
+  int games_played; // Completed games, the server alternates on each one
+} RefState;
+
+void ref_reset(RefState *ref);
+void ref_add_point(RefState *ref, int player); // 0 for P1, 1 for P2
+int ref_display_score(const RefState *ref, int player);
+int ref_server(const RefState *ref);
@@ -1,11 +1,12 @@
 #include "game_menu.h"
 #include "main.h"
 #include "match.h"
+#include "timeline.h"
 #include <pebble.h>
 
 static SimpleMenuLayer *s_simple_menu_layer;
 static SimpleMenuSection s_menu_sections[1];
-static SimpleMenuItem s_menu_items[2];
+static SimpleMenuItem s_menu_items[3];
 static Window *s_menu_window;
 
 static void menu_select_callback(int index, void *ctx) {
@@ -17,6 +18,10 @@ static void menu_select_callback(int index, void *ctx) {
       window_stack_pop(true); // Close menu
     }
   } else if (index == 1) {
+    // Timeline
+    window_stack_pop(true); // Close menu
+    timeline_start();
+  } else if (index == 2) {
     // End Game
     window_stack_pop(true); // Close menu
     window_stack_pop(true); // Close game window (return to mode select)
@@ -34,12 +39,18 @@ static void menu_window_load(Window *window) {
   };
 
   s_menu_items[1] = (SimpleMenuItem){
+      .title = "Timeline",
+      .subtitle = "Review point by point",
+      .callback = menu_select_callback,
+  };
+
+  s_menu_items[2] = (SimpleMenuItem){
       .title = "End Game",
       .callback = menu_select_callback,
   };
 
   s_menu_sections[0] = (SimpleMenuSection){
-      .num_items = 2,
+      .num_items = 3,
       .items = s_menu_items,
   };
 
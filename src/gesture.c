@@ -0,0 +1,197 @@
+#include "gesture.h"
+
+// Sampling: taps on the face are 20-40ms impulses, and at 10Hz most of
+// them fall between samples, so 25Hz is the lowest rate where a double tap
+// is dependable. The largest batch the service allows (25 samples) limits
+// that to one wakeup a second, 3600 an hour.
+//
+// Latency: points are scored when their batch is delivered, up to 1s after
+// the gesture settles. The lockout runs from the end of that batch, so a
+// player repeating the gesture while waiting for the vibe is not scored
+// twice.
+#define SAMPLES_PER_BATCH 25
+
+// Detection tuning (milli-G, milliseconds)
+#define QUIET_THRESHOLD 150  // Per-sample jerk below this counts as still
+#define SPIKE_THRESHOLD 900  // Distance from the resting reading
+#define QUIET_BEFORE_MS 600  // Watch must be still before a gesture
+#define ONSET_MS 200         // ...and peak this soon after it starts moving
+#define GESTURE_MS 500       // Flick return / second tap must land in this
+#define SETTLE_MS 400        // ...and the watch must be still again after
+#define LOCKOUT_MS 1500      // Ignore movement after a point is delivered
+
+// A flick swings the wrist along +X, a tap on the face pushes it into -Z.
+// Both are measured against the resting reading, so a tap's rebound above
+// rest is never a second tap. Racket swings and ball impacts never start
+// from a still watch, so they are rejected before the axis check.
+typedef enum {
+  CANDIDATE_NONE,
+  CANDIDATE_FLICK,
+  CANDIDATE_TAP,
+} Candidate;
+
+static GesturePointHandler s_handler;
+static bool s_subscribed = false;
+
+// Detector State
+static AccelData s_prev_sample;
+static AccelData s_rest_sample;
+static bool s_has_prev = false;
+static Candidate s_candidate = CANDIDATE_NONE;
+static int s_tap_count = 0;
+static bool s_in_tap = false;
+static uint64_t s_candidate_ms = 0;
+static uint64_t s_last_motion_ms = 0;
+static uint64_t s_motion_start_ms = 0;
+static bool s_moving = false;
+static bool s_started_still = false;
+static uint64_t s_lockout_until_ms = 0;
+static uint64_t s_batch_end_ms = 0;
+
+static int abs_int(int value) { return (value < 0) ? -value : value; }
+
+static Candidate classify_spike(const AccelData *sample) {
+  int dx = sample->x - s_rest_sample.x;
+  int dy = sample->y - s_rest_sample.y;
+  int dz = sample->z - s_rest_sample.z;
+  int ax = abs_int(dx);
+  int ay = abs_int(dy);
+  int az = abs_int(dz);
+
+  if (ax + ay + az < SPIKE_THRESHOLD)
+    return CANDIDATE_NONE;
+  if (ax > ay && ax > az && dx > 0)
+    return CANDIDATE_FLICK;
+  if (az > ax && az > ay && dz < 0)
+    return CANDIDATE_TAP;
+  return CANDIDATE_NONE;
+}
+
+static void emit_point(int player) {
+  s_candidate = CANDIDATE_NONE;
+  s_lockout_until_ms = s_batch_end_ms + LOCKOUT_MS;
+  if (s_handler) {
+    s_handler(player);
+  }
+}
+
+static void process_sample(AccelData *sample) {
+  uint64_t now = sample->timestamp;
+
+  // Our own vibes (and any other) corrupt the reading and are not stillness
+  if (sample->did_vibrate) {
+    s_has_prev = false;
+    s_candidate = CANDIDATE_NONE;
+    s_last_motion_ms = now;
+    s_moving = false;
+    return;
+  }
+
+  if (!s_has_prev) {
+    s_prev_sample = *sample;
+    s_rest_sample = *sample;
+    s_has_prev = true;
+    s_last_motion_ms = now; // Stillness is measured from here
+    return;
+  }
+
+  int jerk = abs_int(sample->x - s_prev_sample.x) +
+             abs_int(sample->y - s_prev_sample.y) +
+             abs_int(sample->z - s_prev_sample.z);
+  s_prev_sample = *sample;
+
+  // Remember whether each movement started from a still watch
+  if (jerk >= QUIET_THRESHOLD) {
+    if (!s_moving) {
+      s_moving = true;
+      s_motion_start_ms = now;
+      s_started_still = now - s_last_motion_ms >= QUIET_BEFORE_MS;
+    }
+    s_last_motion_ms = now;
+  } else {
+    s_moving = false;
+  }
+
+  if (now < s_lockout_until_ms)
+    return;
+
+  Candidate spike = classify_spike(sample);
+
+  if (s_candidate == CANDIDATE_NONE) {
+    if (spike != CANDIDATE_NONE && s_moving && s_started_still &&
+        now - s_motion_start_ms <= ONSET_MS) {
+      s_candidate = spike;
+      s_candidate_ms = now;
+      s_in_tap = (spike == CANDIDATE_TAP);
+      s_tap_count = s_in_tap ? 1 : 0;
+    } else if (jerk < QUIET_THRESHOLD) {
+      s_rest_sample = *sample;
+    }
+    return;
+  }
+
+  if (now - s_candidate_ms <= GESTURE_MS) {
+    // Count each new press below rest, however close together
+    if (s_candidate == CANDIDATE_TAP) {
+      bool is_tap = (spike == CANDIDATE_TAP);
+      if (is_tap && !s_in_tap) {
+        s_tap_count++;
+      }
+      s_in_tap = is_tap;
+    }
+    return;
+  }
+
+  // Past the gesture window, any motion before settling means play
+  if (jerk >= QUIET_THRESHOLD) {
+    s_candidate = CANDIDATE_NONE;
+    return;
+  }
+
+  if (now - s_last_motion_ms < SETTLE_MS)
+    return;
+
+  if (s_candidate == CANDIDATE_FLICK) {
+    emit_point(0); // P1
+  } else if (s_tap_count >= 2) {
+    emit_point(1); // P2 (Double Tap)
+  } else {
+    s_candidate = CANDIDATE_NONE; // Single tap scores nothing
+  }
+}
+
+static void accel_data_handler(AccelData *data, uint32_t num_samples) {
+  if (num_samples == 0)
+    return;
+
+  s_batch_end_ms = data[num_samples - 1].timestamp;
+  for (uint32_t i = 0; i < num_samples; i++) {
+    process_sample(&data[i]);
+  }
+}
+
+void gesture_subscribe(GesturePointHandler handler) {
+  if (s_subscribed)
+    return;
+
+  s_handler = handler;
+  s_has_prev = false;
+  s_candidate = CANDIDATE_NONE;
+  s_moving = false;
+  s_lockout_until_ms = 0;
+
+  accel_data_service_subscribe(SAMPLES_PER_BATCH, accel_data_handler);
+  accel_service_set_sampling_rate(ACCEL_SAMPLING_25HZ);
+  s_subscribed = true;
+}
+
+void gesture_unsubscribe() {
+  if (!s_subscribed)
+    return;
+
+  accel_data_service_unsubscribe();
+  s_handler = NULL;
+  s_subscribed = false;
+}
+
+bool gesture_is_subscribed() { return s_subscribed; }
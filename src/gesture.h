@@ -0,0 +1,10 @@
+#pragma once
+
+#include <pebble.h>
+
+// Called with 0 for P1 (wrist flick), 1 for P2 (double tap)
+typedef void (*GesturePointHandler)(int player);
+
+void gesture_subscribe(GesturePointHandler handler);
+void gesture_unsubscribe();
+bool gesture_is_subscribed();
@@ -1,6 +1,9 @@
 #include "game_menu.h"
+#include "gesture.h"
+#include "main.h"
 #include "match.h"
 #include "mode_select.h"
+#include "timeline.h"
 #include <pebble.h>
 
 // Message Keys (matching package.json)
@@ -55,6 +58,8 @@ static char s_p2_name_source[32] = "P2";
 // State
 static bool s_is_standalone = false;
 static int s_remote_server = 0; // 0=P1, 1=P2 (for Remote Mode)
+static bool s_gestures_enabled = false;
+static bool s_is_visible = false; // Not covered by the game menu
 
 // --- Time Handling ---
 
@@ -76,12 +81,10 @@ static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
 
 // --- Display Helpers ---
 
-static void update_name_text() {
+static void render_names(int server) {
   if (!s_main_window)
     return;
 
-  int server = s_is_standalone ? match_get_state()->server : s_remote_server;
-
   snprintf(s_p1_name_buffer, sizeof(s_p1_name_buffer), "%s%s", s_p1_name_source,
            (server == 0) ? " : Serve" : "");
   text_layer_set_text(s_name_p1_layer, s_p1_name_buffer);
@@ -91,12 +94,14 @@ static void update_name_text() {
   text_layer_set_text(s_name_p2_layer, s_p2_name_buffer);
 }
 
-static void update_ui_from_state() {
+static void update_name_text() {
+  render_names(s_is_standalone ? match_get_state()->server : s_remote_server);
+}
+
+static void render_state(const MatchState *state) {
   if (!s_main_window)
     return; // Guard
 
-  MatchState *state = match_get_state();
-
   // Score
   snprintf(s_p1_score_buffer, sizeof(s_p1_score_buffer), "%d", state->p1_score);
   if (state->p1_score == 50)
@@ -125,15 +130,40 @@ static void update_ui_from_state() {
   text_layer_set_text(s_sets_p2_layer, s_p2_sets_buffer);
 
   // Names & Server
-  update_name_text();
+  int server = s_is_standalone ? state->server : s_remote_server;
+  render_names(server);
 
   // Update Serve Icons (*)
-  int server = s_is_standalone ? state->server : s_remote_server;
   layer_set_hidden(text_layer_get_layer(s_serve_icon_p1), server != 0);
   layer_set_hidden(text_layer_get_layer(s_serve_icon_p2), server != 1);
 }
 
-void main_window_update_ui() { update_ui_from_state(); }
+static void update_ui_from_state() { render_state(match_get_state()); }
+
+static void update_status_text() {
+  if (s_gestures_enabled) {
+    main_window_set_status("Gestures On");
+  } else {
+    main_window_set_status(s_is_standalone ? "Standalone" : "AT Remote");
+  }
+}
+
+void main_window_update_ui() {
+  if (!s_main_window)
+    return;
+
+  update_status_text();
+  update_ui_from_state();
+}
+
+void main_window_render_state(const MatchState *state) { render_state(state); }
+
+void main_window_set_status(const char *text) {
+  if (!s_main_window)
+    return;
+
+  text_layer_set_text(s_status_layer, text);
+}
 
 // --- AppMessage Helpers ---
 
@@ -220,24 +250,22 @@ static void inbox_received_callback(DictionaryIterator *iterator,
 
 // --- Button Handlers ---
 
-static void up_click_handler(ClickRecognizerRef recognizer, void *context) {
+static void award_point(int player) {
   if (s_is_standalone) {
-    match_add_point(0); // P1
+    match_add_point(player);
     update_ui_from_state();
   } else {
-    send_action(0); // P1 Point
+    send_action(player); // 0 = P1 Point, 1 = P2 Point
   }
   vibes_short_pulse();
 }
 
+static void up_click_handler(ClickRecognizerRef recognizer, void *context) {
+  award_point(0); // P1
+}
+
 static void down_click_handler(ClickRecognizerRef recognizer, void *context) {
-  if (s_is_standalone) {
-    match_add_point(1); // P2
-    update_ui_from_state();
-  } else {
-    send_action(1); // P2 Point
-  }
-  vibes_short_pulse();
+  award_point(1); // P2
 }
 
 static void select_click_handler(ClickRecognizerRef recognizer, void *context) {
@@ -249,10 +277,92 @@ static void select_click_handler(ClickRecognizerRef recognizer, void *context) {
   vibes_short_pulse();
 }
 
+// --- Gesture Handlers ---
+
+static void gesture_point_handler(int player) { award_point(player); }
+
+// Only sample while the live scoreboard is on screen (not menu or timeline)
+static void update_gesture_subscription() {
+  if (s_gestures_enabled && s_is_visible && !timeline_is_active()) {
+    gesture_subscribe(gesture_point_handler);
+  } else {
+    gesture_unsubscribe();
+  }
+}
+
+static void select_long_click_handler(ClickRecognizerRef recognizer,
+                                      void *context) {
+  // Toggle gesture scoring (flick = P1, double tap = P2)
+  s_gestures_enabled = !s_gestures_enabled;
+  update_gesture_subscription();
+  update_status_text();
+
+  if (s_gestures_enabled) {
+    vibes_double_pulse();
+  } else {
+    vibes_short_pulse();
+  }
+}
+
 static void click_config_provider(void *context) {
   window_single_click_subscribe(BUTTON_ID_UP, up_click_handler);
   window_single_click_subscribe(BUTTON_ID_DOWN, down_click_handler);
   window_single_click_subscribe(BUTTON_ID_SELECT, select_click_handler);
+  window_long_click_subscribe(BUTTON_ID_SELECT, 0, select_long_click_handler,
+                              NULL);
+}
+
+// --- Timeline Handlers ---
+
+static void review_up_click_handler(ClickRecognizerRef recognizer,
+                                    void *context) {
+  timeline_step(-1); // Previous point
+}
+
+static void review_down_click_handler(ClickRecognizerRef recognizer,
+                                      void *context) {
+  timeline_step(1); // Next point
+}
+
+static void review_up_long_click_handler(ClickRecognizerRef recognizer,
+                                         void *context) {
+  timeline_jump_game(-1);
+}
+
+static void review_down_long_click_handler(ClickRecognizerRef recognizer,
+                                           void *context) {
+  timeline_jump_game(1);
+}
+
+static void review_select_click_handler(ClickRecognizerRef recognizer,
+                                        void *context) {
+  timeline_jump_set(1);
+}
+
+static void review_back_click_handler(ClickRecognizerRef recognizer,
+                                      void *context) {
+  timeline_stop(); // Back to the live match
+}
+
+static void review_click_config_provider(void *context) {
+  window_single_click_subscribe(BUTTON_ID_UP, review_up_click_handler);
+  window_single_click_subscribe(BUTTON_ID_DOWN, review_down_click_handler);
+  window_single_click_subscribe(BUTTON_ID_SELECT, review_select_click_handler);
+  window_single_click_subscribe(BUTTON_ID_BACK, review_back_click_handler);
+  window_long_click_subscribe(BUTTON_ID_UP, 0, review_up_long_click_handler,
+                              NULL);
+  window_long_click_subscribe(BUTTON_ID_DOWN, 0, review_down_long_click_handler,
+                              NULL);
+}
+
+void main_window_set_review_controls(bool enabled) {
+  if (!s_main_window)
+    return;
+
+  window_set_click_config_provider(s_main_window,
+                                   enabled ? review_click_config_provider
+                                           : click_config_provider);
+  update_gesture_subscription();
 }
 
 // --- Window Lifecycle ---
@@ -411,8 +521,21 @@ static void main_window_load(Window *window) {
   }
 }
 
+static void main_window_appear(Window *window) {
+  s_is_visible = true;
+  update_gesture_subscription();
+}
+
+static void main_window_disappear(Window *window) {
+  s_is_visible = false;
+  update_gesture_subscription();
+}
+
 static void main_window_unload(Window *window) {
   tick_timer_service_unsubscribe();
+  s_gestures_enabled = false;
+  gesture_unsubscribe();
+  timeline_stop();
 
   text_layer_destroy(s_score_p1_layer);
   text_layer_destroy(s_score_p2_layer);
@@ -444,6 +567,9 @@ void game_window_push(bool is_standalone) {
   window_set_click_config_provider(s_main_window, click_config_provider);
   window_set_window_handlers(s_main_window, (WindowHandlers){
                                                 .load = main_window_load,
+                                                .appear = main_window_appear,
+                                                .disappear =
+                                                    main_window_disappear,
                                                 .unload = main_window_unload,
                                             });
   window_stack_push(s_main_window, true);
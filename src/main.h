@@ -1,5 +1,9 @@
 #pragma once
+#include "match.h"
 #include <pebble.h>
 
 void game_window_push(bool is_standalone);
 void main_window_update_ui();
+void main_window_render_state(const MatchState *state);
+void main_window_set_status(const char *text);
+void main_window_set_review_controls(bool enabled);
@@ -1,9 +1,37 @@
 #include "match.h"
 
+#define MAX_POINTS MATCH_TIMELINE_CAPACITY
+#define MAX_CHECKPOINTS (MAX_POINTS / 4 + 1) // Every game takes 4+ points
+#define CHECKPOINT_MAX_GAP MATCH_TIMELINE_MAX_REPLAY
+
+#define CHECKPOINT_GAME_START 0x01
+#define CHECKPOINT_SET_START 0x02
+#define CHECKPOINT_TIEBREAK 0x04
+
+// Packed MatchState snapshot (10 bytes instead of 32)
+typedef struct {
+  uint16_t point_index; // Points played before this state
+  uint8_t flags;
+  uint8_t server;
+  uint8_t scores[2];
+  uint8_t games[2];
+  uint8_t sets[2];
+} MatchCheckpoint;
+
 static MatchState s_match_state;
 static MatchState s_prev_state;
 static bool s_has_history = false;
 
+// Point History
+static uint8_t s_points[MAX_POINTS / 8]; // Winner bits (0 = P1, 1 = P2)
+static int s_point_count = 0;
+static int s_unrecorded_count = 0; // Points played after the history filled
+static bool s_last_point_recorded = false;
+static MatchCheckpoint s_checkpoints[MAX_CHECKPOINTS];
+static int s_checkpoint_count = 0;
+
+static void add_checkpoint(uint8_t flags);
+
 void match_init() { match_reset(); }
 
 void match_reset() {
@@ -17,6 +45,13 @@ void match_reset() {
   s_match_state.is_tiebreak = false;
 
   s_has_history = false;
+
+  // Timeline always starts with the opening state
+  s_point_count = 0;
+  s_unrecorded_count = 0;
+  s_last_point_recorded = false;
+  s_checkpoint_count = 0;
+  add_checkpoint(CHECKPOINT_GAME_START | CHECKPOINT_SET_START);
 }
 
 MatchState *match_get_state() { return &s_match_state; }
@@ -25,55 +60,57 @@ void match_undo() {
   if (s_has_history) {
     s_match_state = s_prev_state;
     s_has_history = false; // Single level undo for now
+
+    if (s_last_point_recorded) {
+      s_point_count--;
+      s_last_point_recorded = false;
+      while (s_checkpoint_count > 1 &&
+             s_checkpoints[s_checkpoint_count - 1].point_index > s_point_count)
+        s_checkpoint_count--;
+    } else {
+      s_unrecorded_count--;
+    }
   }
 }
 
 bool match_can_undo() { return s_has_history; }
 
-static void handle_game_win(int player) {
-  s_match_state.p1_score = 0;
-  s_match_state.p2_score = 0;
+static void handle_game_win(MatchState *state, int player) {
+  state->p1_score = 0;
+  state->p2_score = 0;
 
   // Toggle server after every game (simplified)
-  s_match_state.server = !s_match_state.server;
+  state->server = !state->server;
 
   if (player == 0) {
-    s_match_state.p1_games++;
+    state->p1_games++;
   } else {
-    s_match_state.p2_games++;
+    state->p2_games++;
   }
 
   // Set Logic (Standard 6 games)
   bool p1_wins_set =
-      (s_match_state.p1_games >= 6 &&
-       s_match_state.p1_games >= s_match_state.p2_games + 2) ||
-      (s_match_state.p1_games == 7 &&
-       s_match_state.p2_games == 6); // Tiebreak win (simplified for now)
+      (state->p1_games >= 6 && state->p1_games >= state->p2_games + 2) ||
+      (state->p1_games == 7 &&
+       state->p2_games == 6); // Tiebreak win (simplified for now)
   bool p2_wins_set =
-      (s_match_state.p2_games >= 6 &&
-       s_match_state.p2_games >= s_match_state.p1_games + 2) ||
-      (s_match_state.p2_games == 7 && s_match_state.p1_games == 6);
+      (state->p2_games >= 6 && state->p2_games >= state->p1_games + 2) ||
+      (state->p2_games == 7 && state->p1_games == 6);
 
   if (p1_wins_set) {
-    s_match_state.p1_sets++;
-    s_match_state.p1_games = 0;
-    s_match_state.p2_games = 0;
+    state->p1_sets++;
+    state->p1_games = 0;
+    state->p2_games = 0;
   } else if (p2_wins_set) {
-    s_match_state.p2_sets++;
-    s_match_state.p1_games = 0;
-    s_match_state.p2_games = 0;
+    state->p2_sets++;
+    state->p1_games = 0;
+    state->p2_games = 0;
   }
 }
 
-void match_add_point(int player) {
-  // Save state for undo
-  s_prev_state = s_match_state;
-  s_has_history = true;
-
-  int *scorer_score =
-      (player == 0) ? &s_match_state.p1_score : &s_match_state.p2_score;
-  int *opponent_score =
-      (player == 0) ? &s_match_state.p2_score : &s_match_state.p1_score;
+static void apply_point(MatchState *state, int player) {
+  int *scorer_score = (player == 0) ? &state->p1_score : &state->p2_score;
+  int *opponent_score = (player == 0) ? &state->p2_score : &state->p1_score;
 
   // Standard Game Logic
   if (*scorer_score == 0) {
@@ -85,7 +122,7 @@ void match_add_point(int player) {
   } else if (*scorer_score == 40) {
     if (*opponent_score < 40) {
       // Game Win
-      handle_game_win(player);
+      handle_game_win(state, player);
     } else if (*opponent_score == 40) {
       // Deuce -> Ad
       *scorer_score = 50; // Use 50 for Ad
@@ -95,6 +132,158 @@ void match_add_point(int player) {
     }
   } else if (*scorer_score == 50) {
     // Ad -> Game Win
-    handle_game_win(player);
+    handle_game_win(state, player);
+  }
+}
+
+// --- Timeline ---
+
+static void add_checkpoint(uint8_t flags) {
+  if (s_checkpoint_count >= MAX_CHECKPOINTS)
+    return;
+
+  if (s_match_state.is_tiebreak)
+    flags |= CHECKPOINT_TIEBREAK;
+
+  s_checkpoints[s_checkpoint_count++] = (MatchCheckpoint){
+      .point_index = s_point_count,
+      .flags = flags,
+      .server = s_match_state.server,
+      .scores = {s_match_state.p1_score, s_match_state.p2_score},
+      .games = {s_match_state.p1_games, s_match_state.p2_games},
+      .sets = {s_match_state.p1_sets, s_match_state.p2_sets},
+  };
+}
+
+static void load_checkpoint(const MatchCheckpoint *checkpoint,
+                            MatchState *state) {
+  state->p1_score = checkpoint->scores[0];
+  state->p2_score = checkpoint->scores[1];
+  state->p1_games = checkpoint->games[0];
+  state->p2_games = checkpoint->games[1];
+  state->p1_sets = checkpoint->sets[0];
+  state->p2_sets = checkpoint->sets[1];
+  state->server = checkpoint->server;
+  state->is_tiebreak = (checkpoint->flags & CHECKPOINT_TIEBREAK) != 0;
+}
+
+static int point_winner(int index) {
+  return (s_points[index / 8] >> (index % 8)) & 1;
+}
+
+static void record_point(int player) {
+  s_last_point_recorded = false;
+  if (s_point_count >= MAX_POINTS) {
+    s_unrecorded_count++; // Timeline full, live scoring carries on
+    return;
+  }
+
+  uint8_t bit = 1 << (s_point_count % 8);
+  if (player) {
+    s_points[s_point_count / 8] |= bit;
+  } else {
+    s_points[s_point_count / 8] &= ~bit;
+  }
+  s_point_count++;
+  s_last_point_recorded = true;
+
+  MatchCheckpoint *last = &s_checkpoints[s_checkpoint_count - 1];
+  uint8_t flags = 0;
+  if (s_match_state.p1_score == 0 && s_match_state.p2_score == 0)
+    flags |= CHECKPOINT_GAME_START;
+  if (s_match_state.p1_sets != s_prev_state.p1_sets ||
+      s_match_state.p2_sets != s_prev_state.p2_sets)
+    flags |= CHECKPOINT_SET_START;
+
+  if (flags || s_point_count - last->point_index >= CHECKPOINT_MAX_GAP)
+    add_checkpoint(flags);
+}
+
+// Index of the last checkpoint at or before point_index
+static int find_checkpoint(int point_index) {
+  int lo = 0;
+  int hi = s_checkpoint_count - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (s_checkpoints[mid].point_index <= point_index) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  return lo;
+}
+
+// Recorded points, plus one final position for the live state if the
+// history filled up before the match ended
+int match_timeline_length() {
+  return s_point_count + (s_unrecorded_count > 0 ? 1 : 0);
+}
+
+void match_timeline_seek(MatchCursor *cursor, int point_index) {
+  if (point_index < 0)
+    point_index = 0;
+
+  // The end of the timeline is always the live match
+  int length = match_timeline_length();
+  if (point_index >= length) {
+    cursor->point_index = length;
+    cursor->state = s_match_state;
+    return;
   }
+
+  // Replay from the nearest checkpoint, or from the cursor if it is closer
+  int checkpoint = find_checkpoint(point_index);
+  if (cursor->point_index < s_checkpoints[checkpoint].point_index ||
+      cursor->point_index > point_index) {
+    cursor->point_index = s_checkpoints[checkpoint].point_index;
+    load_checkpoint(&s_checkpoints[checkpoint], &cursor->state);
+  }
+
+  while (cursor->point_index < point_index) {
+    apply_point(&cursor->state, point_winner(cursor->point_index));
+    cursor->point_index++;
+  }
+}
+
+int match_timeline_replay_cost(int point_index) {
+  if (point_index < 0 || point_index >= match_timeline_length())
+    return 0; // Live state is never replayed
+
+  return point_index - s_checkpoints[find_checkpoint(point_index)].point_index;
+}
+
+static int find_boundary(int point_index, int direction, uint8_t flag) {
+  if (direction < 0) {
+    for (int i = find_checkpoint(point_index - 1); i >= 0; i--) {
+      if ((s_checkpoints[i].flags & flag) &&
+          s_checkpoints[i].point_index < point_index)
+        return s_checkpoints[i].point_index;
+    }
+    return 0;
+  }
+
+  for (int i = find_checkpoint(point_index); i < s_checkpoint_count; i++) {
+    if ((s_checkpoints[i].flags & flag) &&
+        s_checkpoints[i].point_index > point_index)
+      return s_checkpoints[i].point_index;
+  }
+  return match_timeline_length(); // Live state
+}
+
+int match_timeline_game_boundary(int point_index, int direction) {
+  return find_boundary(point_index, direction, CHECKPOINT_GAME_START);
+}
+
+int match_timeline_set_boundary(int point_index, int direction) {
+  return find_boundary(point_index, direction, CHECKPOINT_SET_START);
+}
+
+void match_add_point(int player) {
+  // Save state for undo
+  s_prev_state = s_match_state;
+  s_has_history = true;
+
+  apply_point(&s_match_state, player);
+  record_point(player);
 }
@@ -2,6 +2,11 @@
 
 #include <pebble.h>
 
+// Timeline capacity (the longest recorded match was 980 points)
+#define MATCH_TIMELINE_CAPACITY 1024
+// Most points a seek replays from its checkpoint (long deuce games)
+#define MATCH_TIMELINE_MAX_REPLAY 32
+
 typedef struct {
   int p1_score; // 0, 15, 30, 40, 50 (Ad)
   int p2_score;
@@ -13,9 +18,22 @@ typedef struct {
   bool is_tiebreak;
 } MatchState;
 
+// Replay position in the point history
+typedef struct {
+  int point_index; // Points played, 0 = start of match
+  MatchState state;
+} MatchCursor;
+
 void match_init();
 void match_add_point(int player); // 0 for P1, 1 for P2
 MatchState *match_get_state();
 void match_reset();
 void match_undo();
 bool match_can_undo();
+
+// Timeline (history is not changed by seeking)
+int match_timeline_length();
+void match_timeline_seek(MatchCursor *cursor, int point_index);
+int match_timeline_game_boundary(int point_index, int direction); // -1 / +1
+int match_timeline_set_boundary(int point_index, int direction);
+int match_timeline_replay_cost(int point_index); // Points a fresh seek replays
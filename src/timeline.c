@@ -0,0 +1,54 @@
+#include "timeline.h"
+#include "main.h"
+#include "match.h"
+
+static bool s_active = false;
+static MatchCursor s_cursor;
+static char s_status_buffer[24];
+
+static void show_cursor() {
+  snprintf(s_status_buffer, sizeof(s_status_buffer), "Pt %d of %d",
+           s_cursor.point_index, match_timeline_length());
+  main_window_set_status(s_status_buffer);
+  main_window_render_state(&s_cursor.state);
+}
+
+static void seek(int point_index) {
+  match_timeline_seek(&s_cursor, point_index);
+  show_cursor();
+}
+
+void timeline_start() {
+  s_active = true;
+  main_window_set_review_controls(true);
+
+  // Invalidate the cursor, history may have changed since the last review
+  s_cursor.point_index = -1;
+  seek(match_timeline_length()); // Open on the live state
+}
+
+void timeline_stop() {
+  if (!s_active)
+    return;
+
+  s_active = false;
+  main_window_set_review_controls(false);
+  main_window_update_ui();
+}
+
+bool timeline_is_active() { return s_active; }
+
+void timeline_step(int direction) { seek(s_cursor.point_index + direction); }
+
+void timeline_jump_game(int direction) {
+  seek(match_timeline_game_boundary(s_cursor.point_index, direction));
+}
+
+void timeline_jump_set(int direction) {
+  // Wrap from the live state back to the opening point
+  if (direction > 0 && s_cursor.point_index == match_timeline_length()) {
+    seek(0);
+    return;
+  }
+  seek(match_timeline_set_boundary(s_cursor.point_index, direction));
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <pebble.h>
+
+// Point-by-point review of the standalone match on the scoreboard
+void timeline_start();
+void timeline_stop();
+bool timeline_is_active();
+void timeline_step(int direction);      // -1 / +1 point
+void timeline_jump_game(int direction); // Start of previous / next game
+void timeline_jump_set(int direction);  // Start of previous / next set
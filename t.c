@@ -0,0 +1,20 @@
+#include "/root/repo/src/gesture.c"
+#include <stdio.h>
+static int got[2];
+static void h(int p){got[p]++;}
+static uint64_t t=1000000;
+static void feed(int x,int y,int z){AccelData d={x,y,z,false,t};t+=100;g_h(&d,1);}
+static void still(int n){for(int i=0;i<n;i++)feed(0,0,-1000);}
+int main(){
+ gesture_subscribe(h);
+ still(20); feed(1000,0,-1000); feed(0,0,-1000); still(20);
+ printf("flick: p1=%d p2=%d\n",got[0],got[1]);
+ still(20); feed(0,0,-2000); feed(0,0,-1000); feed(0,0,-1000); feed(0,0,-2000); feed(0,0,-1000); still(20);
+ printf("dtap: p1=%d p2=%d\n",got[0],got[1]);
+ still(20); feed(0,0,-2000); feed(0,0,-1000); still(20);
+ printf("single tap: p1=%d p2=%d\n",got[0],got[1]);
+ still(20); feed(0,0,-2000); feed(0,0,-2000); feed(0,0,-1000); still(20);
+ printf("consecutive dtap: p1=%d p2=%d\n",got[0],got[1]);
+ still(20); feed(0,0,-2000); feed(0,0,-1000);feed(0,0,-2000); feed(0,0,-1000); still(20);
+ printf("dtap 200ms: p1=%d p2=%d\n",got[0],got[1]);
+}